@@ -174,6 +174,9 @@ class P44Vdcd : public CmdLineApp
   // protocol support
   int mProtocols;
 
+  // startup timing
+  MLMicroSeconds mStartupTime; // time when initialisation started, Never once initial device collection is done
+
 public:
 
   P44Vdcd() :
@@ -184,7 +187,8 @@ public:
     mCurrentTempStatus(tempstatus_none),
     mFactoryResetWait(false),
     mLowLevelButtonOnly(false),
-    mProtocols(PF_INET)
+    mProtocols(PF_INET),
+    mStartupTime(Never)
   {
   }
 
@@ -1141,6 +1145,7 @@ public:
 
   virtual void initialize() P44_OVERRIDE
   {
+    mStartupTime = MainLoop::now();
     #if ENABLE_LVGL
     // start UI in both test / non-test cases
     const char *lvglParams = getOption("lvgl");
@@ -1205,6 +1210,7 @@ public:
     }
     else {
       // Initialized ok and not testing
+      LOG(LOG_NOTICE, "vdc host initialized %.3f seconds after startup", (double)(MainLoop::now()-mStartupTime)/Second);
       #if !DISABLE_DISCOVERY
       // - initialize discovery
       initDiscovery();
@@ -1235,6 +1241,11 @@ public:
 
   virtual void devicesCollected(ErrorPtr aError)
   {
+    if (mStartupTime!=Never) {
+      // first collection after startup, report how long it took until all devices were available
+      LOG(LOG_NOTICE, "initial device collection done %.3f seconds after startup", (double)(MainLoop::now()-mStartupTime)/Second);
+      mStartupTime = Never;
+    }
     if (Error::isOK(aError)) {
       setAppStatus(status_ok);
     }